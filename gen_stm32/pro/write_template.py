@@ -106,22 +106,32 @@ class WriteTemplate(FileCheck):
         build_src_dir: str = f'{build_dir}source/'
         driver: str = 'STM32F4xx_StdPeriph_Driver'
         build_inc_dir: str = f'{build_dir}includes/{driver}/src/'
+        middleware: str = 'Middleware'
+        build_mw_dir: str = f'{build_dir}includes/{middleware}/src/'
         scripts_dir: str = f'{pro_dir}scripts/'
+        runtime_nano_dir: str = f'{scripts_dir}runtime_nano/'
+        runtime_legacy_dir: str = f'{scripts_dir}runtime_legacy/'
         source_dir: str = f'{pro_dir}source/'
         includes_dir: str = f'{pro_dir}includes/'
         cmsis_dir: str = f'{includes_dir}CMSIS/'
         stm32f4xx_dir: str = f'{includes_dir}STM32F4xx/'
         stm32f4xx_driver_src_dir: str = f'{includes_dir}{driver}/src/'
         stm32f4xx_driver_inc_dir: str = f'{includes_dir}{driver}/inc/'
+        middleware_src_dir: str = f'{includes_dir}{middleware}/src/'
+        middleware_inc_dir: str = f'{includes_dir}{middleware}/inc/'
+        test_dir: str = f'{pro_dir}test/'
         num_of_modules: int = len(templates)
         check_structure: bool = any([
             not exists(pro_dir), not exists(build_dir),
             not exists(build_src_dir), not exists(build_inc_dir),
-            not exists(scripts_dir), not exists(source_dir),
+            not exists(scripts_dir), not exists(runtime_nano_dir),
+            not exists(runtime_legacy_dir), not exists(source_dir),
             not exists(includes_dir), not exists(cmsis_dir),
             not exists(stm32f4xx_dir),
             not exists(stm32f4xx_driver_src_dir),
-            not exists(stm32f4xx_driver_inc_dir)
+            not exists(stm32f4xx_driver_inc_dir),
+            not exists(build_mw_dir), not exists(middleware_src_dir),
+            not exists(middleware_inc_dir), not exists(test_dir)
         ])
         if check_structure:
             makedirs(pro_dir)
@@ -129,12 +139,18 @@ class WriteTemplate(FileCheck):
             makedirs(build_src_dir)
             makedirs(build_inc_dir)
             makedirs(scripts_dir)
+            makedirs(runtime_nano_dir)
+            makedirs(runtime_legacy_dir)
             makedirs(source_dir)
             makedirs(includes_dir)
             makedirs(cmsis_dir)
             makedirs(stm32f4xx_dir)
             makedirs(stm32f4xx_driver_src_dir)
             makedirs(stm32f4xx_driver_inc_dir)
+            makedirs(build_mw_dir)
+            makedirs(middleware_src_dir)
+            makedirs(middleware_inc_dir)
+            makedirs(test_dir)
         for template_content in templates:
             module_name: str = list(template_content.keys())[0]
             template: Template = Template(template_content[module_name])
@@ -39,12 +39,17 @@ CONF: str = 'conf'
 BUILD: str = 'conf/template/build/'
 BUILD_SRC: str = 'conf/template/build/includes/STM32F4xx_StdPeriph_Driver/src/'
 BUILD_INC: str = 'conf/template/build/source/'
+BUILD_MW: str = 'conf/template/build/includes/Middleware/src/'
 CMSIS: str = 'conf/template/includes/CMSIS/'
 STM32F4XX: str = 'conf/template/includes/STM32F4xx/'
 DRIVER_INC: str = 'conf/template/includes/STM32F4xx_StdPeriph_Driver/inc/'
 DRIVER_SRC: str = 'conf/template/includes/STM32F4xx_StdPeriph_Driver/src/'
+MW_INC: str = 'conf/template/includes/Middleware/inc/'
+MW_SRC: str = 'conf/template/includes/Middleware/src/'
 SCRIPTS: str = 'conf/template/scripts/'
 SOURCE: str = 'conf/template/source/'
+TEST: str = 'conf/template/test/'
+TEMPLATE: str = 'conf/template/'
 LOG: str = 'log'
 THIS_DIR: str = abspath(dirname(__file__))
 long_description: Optional[str] = None
@@ -79,10 +84,12 @@ setup(
             f'{CONF}/gen_stm32_util.cfg',
             f'{CONF}/project.yaml',
             f'{BUILD}Makefile.template',
+            f'{BUILD}cmsis_dsp.template',
             f'{BUILD}objects.template',
             f'{BUILD}sources.template',
             f'{BUILD_INC}subdir.template',
             f'{BUILD_INC}subdir.template',
+            f'{BUILD_MW}subdir.template',
             f'{CMSIS}arm_common_tables.template',
             f'{CMSIS}arm_math.template',
             f'{CMSIS}core_cm0.template',
@@ -91,6 +98,8 @@ setup(
             f'{CMSIS}core_cm4_simd.template',
             f'{CMSIS}core_cmFunc.template',
             f'{CMSIS}core_cmInstr.template',
+            f'{STM32F4XX}can_plan.template',
+            f'{STM32F4XX}irq_plan.template',
             f'{STM32F4XX}stm32f4xx.template',
             f'{STM32F4XX}stm32f4xx_conf.template',
             f'{STM32F4XX}system_stm32f4xx.template',
@@ -151,12 +160,81 @@ setup(
             f'{DRIVER_INC}stm32f4xx_tim.template',
             f'{DRIVER_INC}stm32f4xx_usart.template',
             f'{DRIVER_INC}stm32f4xx_wwdg.template',
+            f'{MW_INC}adc_stream.template',
+            f'{MW_INC}aes_dma.template',
+            f'{MW_INC}can_bus.template',
+            f'{MW_INC}crc32_sw.template',
+            f'{MW_INC}crc_dma.template',
+            f'{MW_INC}cycle_counter.template',
+            f'{MW_INC}dcmi_capture.template',
+            f'{MW_INC}dma_stream.template',
+            f'{MW_INC}event_flags.template',
+            f'{MW_INC}ext_heap.template',
+            f'{MW_INC}flash_kv.template',
+            f'{MW_INC}hash_dma.template',
+            f'{MW_INC}i2c_dma.template',
+            f'{MW_INC}irq.template',
+            f'{MW_INC}irq_lock.template',
+            f'{MW_INC}itm_log.template',
+            f'{MW_INC}lockfree.template',
+            f'{MW_INC}mpsc_queue.template',
+            f'{MW_INC}mpu_guard.template',
+            f'{MW_INC}rng_pool.template',
+            f'{MW_INC}runtime_bench.template',
+            f'{MW_INC}sd_blk.template',
+            f'{MW_INC}sd_card.template',
+            f'{MW_INC}semihost.template',
+            f'{MW_INC}spi_dma.template',
+            f'{MW_INC}spsc_ring.template',
+            f'{MW_INC}stack_mon.template',
+            f'{MW_INC}target_test.template',
+            f'{MW_INC}tim_dma.template',
+            f'{MW_INC}uart_dma.template',
+            f'{MW_SRC}adc_stream.template',
+            f'{MW_SRC}aes_dma.template',
+            f'{MW_SRC}can_bus.template',
+            f'{MW_SRC}crc_dma.template',
+            f'{MW_SRC}dcmi_capture.template',
+            f'{MW_SRC}ext_heap.template',
+            f'{MW_SRC}flash_kv.template',
+            f'{MW_SRC}hash_dma.template',
+            f'{MW_SRC}i2c_dma.template',
+            f'{MW_SRC}irq.template',
+            f'{MW_SRC}itm_log.template',
+            f'{MW_SRC}mpu_guard.template',
+            f'{MW_SRC}rng_pool.template',
+            f'{MW_SRC}runtime_bench.template',
+            f'{MW_SRC}sd_blk.template',
+            f'{MW_SRC}sd_card.template',
+            f'{MW_SRC}semihost.template',
+            f'{MW_SRC}spi_dma.template',
+            f'{MW_SRC}stack_mon.template',
+            f'{MW_SRC}target_test.template',
+            f'{MW_SRC}tim_dma.template',
+            f'{MW_SRC}uart_dma.template',
             f'{SCRIPTS}arm_cortex_m4_512.template',
+            f'{SCRIPTS}can_plan.template',
+            f'{SCRIPTS}irq_plan.template',
+            f'{SCRIPTS}itm_decode.template',
+            f'{SCRIPTS}qemu_run.template',
+            f'{SCRIPTS}runtime_legacy/runtime.template',
+            f'{SCRIPTS}runtime_nano/runtime.template',
+            f'{SCRIPTS}stack_check.template',
+            f'{SOURCE}can_plan.template',
+            f'{SOURCE}irq_plan.template',
             f'{SOURCE}main.template',
             f'{SOURCE}startup_stm32f4xx.template',
+            f'{SOURCE}stm32f4xx_host.template',
             f'{SOURCE}syscall.template',
             f'{SOURCE}system_stm32f4xx.template',
             f'{SOURCE}tinynew.template',
+            f'{TEST}Makefile.template',
+            f'{TEST}crc32_reference.template',
+            f'{TEST}driver_host.template',
+            f'{TEST}lockfree_stress.template',
+            f'{TEST}qemu_test.template',
+            f'{TEMPLATE}can_plan.template',
+            f'{TEMPLATE}irq_plan.template',
             f'{LOG}/gen_stm32.log'
         ]
     },